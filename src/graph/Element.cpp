@@ -12,7 +12,7 @@ public:
     BasicElement(const std::string& id, int index)
         : id(id), index(index) {}
 
-    std::string getId() const override {
+    const std::string& getId() const override {
         return id;
     }
 
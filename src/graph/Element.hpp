@@ -14,7 +14,7 @@ public:
     virtual ~Element() = default;
 
     // Unique identifier of this element.
-    virtual std::string getId() const = 0;
+    virtual const std::string& getId() const = 0;
 
     // The current index of this element.
     virtual int getIndex() const = 0;
@@ -229,7 +229,7 @@ public:
         edgesList.push_back(edge);
     }
 
-    std::string getId() const override {
+    const std::string& getId() const override {
         return id;
     }
 };
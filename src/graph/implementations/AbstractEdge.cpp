@@ -17,6 +17,10 @@ void AbstractEdge::attributeChanged(const std::string& event, const std::string&
     }
 }
 
+bool AbstractEdge::hasAttributeListeners() const {
+    return graph != nullptr && !graph->listeners.attributeSinks().empty();
+}
+
 // String representation of the edge
 std::string AbstractEdge::toString() const {
     std::ostringstream oss;
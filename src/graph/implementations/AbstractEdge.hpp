@@ -33,6 +33,9 @@ public:
     virtual Node* getTargetNode() const override;
     virtual bool isDirected() const override;
     virtual bool isLoop() const override;
+
+protected:
+    bool hasAttributeListeners() const override;
 };
 
 #endif // ABSTRACT_EDGE_HPP
@@ -1,13 +1,14 @@
 #include "AbstractElement.hpp"
+#include <limits>
 
 // Constructor implementation
 AbstractElement::AbstractElement(const std::string& id)
-    : id(id), index(-1) {
+    : id(id), index(-1), handle(IdInterner::INVALID), columns(nullptr) {
     assert(!id.empty() && "Graph elements cannot have a null identifier");
 }
 
 // Access methods implementation
-std::string AbstractElement::getId() const {
+const std::string& AbstractElement::getId() const {
     return id;
 }
 
@@ -19,12 +20,25 @@ void AbstractElement::setIndex(int newIndex) {
     index = newIndex;
 }
 
+ElementHandle AbstractElement::getHandle() const {
+    return handle;
+}
+
+void AbstractElement::setHandle(ElementHandle newHandle) {
+    handle = newHandle;
+}
+
 // Attribute methods implementation
 std::shared_ptr<void> AbstractElement::getAttribute(const std::string& key) const {
     auto it = attributes.find(key);
     if (it != attributes.end()) {
         return it->second;
     }
+
+    int keyId = columnKey(key);
+    if (keyId >= 0) {
+        return columns->box(keyId, index);
+    }
     return nullptr;
 }
 
@@ -43,30 +57,53 @@ void AbstractElement::setAttribute(const std::string& attribute, std::initialize
     AttributeChangeEvent event = it != attributes.end() ? AttributeChangeEvent::CHANGE : AttributeChangeEvent::ADD;
 
     std::shared_ptr<void> oldValue = it != attributes.end() ? it->second : nullptr;
+
+    int keyId = columnKey(attribute);
+    if (keyId >= 0) {
+        event = AttributeChangeEvent::CHANGE;
+        oldValue = columns->box(keyId, index);
+        columns->remove(keyId, index);
+    }
+
     attributes[attribute] = value;
 
     attributeChanged(event, attribute, oldValue, value);
 }
 
 void AbstractElement::removeAttribute(const std::string& attribute) {
-    if (attributes.find(attribute) != attributes.end() && 
+    auto it = attributes.find(attribute);
+    int keyId = columnKey(attribute);
+    bool inColumns = keyId >= 0;
+
+    if ((it != attributes.end() || inColumns) &&
         std::find(attributesBeingRemoved.begin(), attributesBeingRemoved.end(), attribute) == attributesBeingRemoved.end()) {
 
         attributesBeingRemoved.push_back(attribute);
 
-        attributeChanged(AttributeChangeEvent::REMOVE, attribute, attributes[attribute], nullptr);
+        std::shared_ptr<void> oldValue = it != attributes.end() ? it->second : columns->box(keyId, index);
+        attributeChanged(AttributeChangeEvent::REMOVE, attribute, oldValue, nullptr);
 
         attributesBeingRemoved.pop_back();
-        attributes.erase(attribute);
+
+        if (inColumns) {
+            columns->remove(keyId, index);
+        } else {
+            attributes.erase(attribute);
+        }
     }
 }
 
 bool AbstractElement::hasAttribute(const std::string& key) const {
-    return attributes.find(key) != attributes.end();
+    return attributes.find(key) != attributes.end() || columnKey(key) >= 0;
 }
 
 int AbstractElement::getAttributeCount() const {
-    return attributes.size();
+    int count = attributes.size();
+
+    if (columns != nullptr && index >= 0) {
+        count += columns->countOf(index);
+    }
+    return count;
 }
 
 void AbstractElement::clearAttributes() {
@@ -74,10 +111,179 @@ void AbstractElement::clearAttributes() {
         attributeChanged(AttributeChangeEvent::REMOVE, entry.first, entry.second, nullptr);
     }
     attributes.clear();
+
+    if (columns != nullptr && index >= 0) {
+        for (int k = 0; k < columns->getKeyCount(); k++) {
+            if (columns->has(k, index)) {
+                attributeChanged(AttributeChangeEvent::REMOVE, columns->keyOf(k), columns->box(k, index), nullptr);
+            }
+        }
+        columns->clearSlot(index);
+    }
 }
 
 void AbstractElement::clearAttributesWithNoEvent() {
     attributes.clear();
+
+    if (columns != nullptr && index >= 0) {
+        columns->clearSlot(index);
+    }
+}
+
+std::vector<std::string> AbstractElement::attributeKeys() const {
+    std::vector<std::string> keys;
+    keys.reserve(attributes.size());
+
+    for (const auto& entry : attributes) {
+        keys.push_back(entry.first);
+    }
+
+    if (columns != nullptr && index >= 0) {
+        columns->keysOf(index, keys);
+    }
+    return keys;
+}
+
+// Typed attribute methods implementation
+template<typename Setter>
+void AbstractElement::setTyped(const std::string& attribute, Setter&& set) {
+    int keyId = columns->intern(attribute);
+    bool notify = hasAttributeListeners();
+
+    std::shared_ptr<void> oldValue;
+    bool existed = columns->has(keyId, index);
+
+    auto it = attributes.find(attribute);
+    if (it != attributes.end()) {
+        oldValue = it->second;
+        existed = true;
+        attributes.erase(it);
+    } else if (notify && existed) {
+        oldValue = columns->box(keyId, index);
+    }
+
+    set(keyId);
+
+    if (notify) {
+        attributeChanged(existed ? AttributeChangeEvent::CHANGE : AttributeChangeEvent::ADD,
+                         attribute, oldValue, columns->box(keyId, index));
+    }
+}
+
+void AbstractElement::setNumber(const std::string& attribute, double value) {
+    if (columns == nullptr || index < 0) {
+        setAttribute(attribute, { std::make_shared<double>(value) });
+        return;
+    }
+    setTyped(attribute, [&](int keyId) { columns->setDouble(keyId, index, value); });
+}
+
+void AbstractElement::setInteger(const std::string& attribute, int64_t value) {
+    if (columns == nullptr || index < 0) {
+        setAttribute(attribute, { std::make_shared<int64_t>(value) });
+        return;
+    }
+    setTyped(attribute, [&](int keyId) { columns->setInt64(keyId, index, value); });
+}
+
+void AbstractElement::setLabel(const std::string& attribute, const std::string& value) {
+    if (columns == nullptr || index < 0) {
+        setAttribute(attribute, { std::make_shared<std::string>(value) });
+        return;
+    }
+    setTyped(attribute, [&](int keyId) { columns->setString(keyId, index, value); });
+}
+
+double AbstractElement::getNumber(const std::string& key) const {
+    int keyId = columnKey(key);
+
+    if (keyId >= 0) {
+        switch (columns->kindOf(keyId, index)) {
+        case AttributeColumns::Kind::DOUBLE:
+            return columns->getDouble(keyId, index);
+        case AttributeColumns::Kind::INT64:
+            return static_cast<double>(columns->getInt64(keyId, index));
+        default:
+            break;
+        }
+    }
+
+    auto it = attributes.find(key);
+    if (it != attributes.end() && it->second) {
+        return *std::static_pointer_cast<double>(it->second);
+    }
+    return std::numeric_limits<double>::quiet_NaN();
+}
+
+int64_t AbstractElement::getInteger(const std::string& key) const {
+    int keyId = columnKey(key);
+
+    if (keyId >= 0) {
+        switch (columns->kindOf(keyId, index)) {
+        case AttributeColumns::Kind::INT64:
+            return columns->getInt64(keyId, index);
+        case AttributeColumns::Kind::DOUBLE:
+            return static_cast<int64_t>(columns->getDouble(keyId, index));
+        default:
+            break;
+        }
+    }
+
+    auto it = attributes.find(key);
+    if (it != attributes.end() && it->second) {
+        return *std::static_pointer_cast<int64_t>(it->second);
+    }
+    return 0;
+}
+
+std::string AbstractElement::getLabel(const std::string& key) const {
+    int keyId = columnKey(key);
+
+    if (keyId >= 0 && columns->kindOf(keyId, index) == AttributeColumns::Kind::STRING) {
+        return columns->getString(keyId, index);
+    }
+
+    auto it = attributes.find(key);
+    if (it != attributes.end() && it->second) {
+        return *std::static_pointer_cast<std::string>(it->second);
+    }
+    return "";
+}
+
+// Column storage
+void AbstractElement::attachColumns(AttributeColumns* store) {
+    columns = store;
+}
+
+void AbstractElement::detachColumns(bool keepValues) {
+    if (columns == nullptr) {
+        return;
+    }
+
+    if (index >= 0) {
+        if (keepValues) {
+            for (int k = 0; k < columns->getKeyCount(); k++) {
+                if (columns->has(k, index)) {
+                    attributes[columns->keyOf(k)] = columns->box(k, index);
+                }
+            }
+        }
+        columns->clearSlot(index);
+    }
+    columns = nullptr;
+}
+
+bool AbstractElement::hasAttributeListeners() const {
+    return true;
+}
+
+int AbstractElement::columnKey(const std::string& key) const {
+    if (columns == nullptr || index < 0) {
+        return -1;
+    }
+
+    int keyId = columns->find(key);
+    return keyId >= 0 && columns->has(keyId, index) ? keyId : -1;
 }
 
 // Utility method
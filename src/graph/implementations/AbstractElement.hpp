@@ -10,12 +10,15 @@
 #include <algorithm>
 #include <typeinfo>
 #include <iostream>
+#include <cstdint>
+#include "AttributeColumns.hpp"
+#include "util/IdInterner.hpp"
 
 class Element {
 public:
     virtual ~Element() = default;
 
-    virtual std::string getId() const = 0;
+    virtual const std::string& getId() const = 0;
     virtual int getIndex() const = 0;
     virtual void setAttribute(const std::string& attribute, std::initializer_list<std::shared_ptr<void>> values) = 0;
     virtual void removeAttribute(const std::string& attribute) = 0;
@@ -38,17 +41,24 @@ protected:
     // Fields
     std::string id;
     int index;
+    ElementHandle handle;
     std::map<std::string, std::shared_ptr<void>> attributes;
     std::vector<std::string> attributesBeingRemoved;
 
+    // Typed attributes live in the graph columns while the element is
+    // attached to a graph, and in the attribute map otherwise.
+    AttributeColumns* columns;
+
 public:
     // Constructor
     explicit AbstractElement(const std::string& id);
 
     // Access methods
-    std::string getId() const override;
+    const std::string& getId() const override;
     int getIndex() const override;
     void setIndex(int newIndex);
+    ElementHandle getHandle() const;
+    void setHandle(ElementHandle newHandle);
 
     // Attribute methods
     std::shared_ptr<void> getAttribute(const std::string& key) const;
@@ -58,6 +68,19 @@ public:
     int getAttributeCount() const override;
     void clearAttributes();
     void clearAttributesWithNoEvent();
+    std::vector<std::string> attributeKeys() const;
+
+    // Typed attribute methods
+    void setNumber(const std::string& attribute, double value);
+    void setInteger(const std::string& attribute, int64_t value);
+    void setLabel(const std::string& attribute, const std::string& value);
+    double getNumber(const std::string& key) const;
+    int64_t getInteger(const std::string& key) const;
+    std::string getLabel(const std::string& key) const;
+
+    // Column storage
+    void attachColumns(AttributeColumns* store);
+    void detachColumns(bool keepValues);
 
     // Abstract method to handle attribute changes
     virtual void attributeChanged(AttributeChangeEvent event, const std::string& attribute,
@@ -65,6 +88,16 @@ public:
 
     // Utility method
     std::string toString() const override;
+
+protected:
+    // Whether attribute changes have an audience. When false, typed setters
+    // skip boxing values for attributeChanged().
+    virtual bool hasAttributeListeners() const;
+
+private:
+    template<typename Setter>
+    void setTyped(const std::string& attribute, Setter&& set);
+    int columnKey(const std::string& key) const;
 };
 
 #endif // ABSTRACT_ELEMENT_HPP
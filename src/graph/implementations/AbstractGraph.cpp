@@ -76,7 +76,12 @@ void AbstractGraph::clear() {
 }
 
 std::shared_ptr<Node> AbstractGraph::addNode(const std::string& id) {
-    auto node = std::dynamic_pointer_cast<AbstractNode>(getNode(id));
+    return addNode(ids.intern(id));
+}
+
+std::shared_ptr<Node> AbstractGraph::addNode(ElementHandle handle) {
+    auto node = std::dynamic_pointer_cast<AbstractNode>(getNode(handle));
+    const std::string& id = ids.idOf(handle);
 
     if (node != nullptr) {
         if (strictChecking) {
@@ -86,6 +91,7 @@ std::shared_ptr<Node> AbstractGraph::addNode(const std::string& id) {
     }
 
     node = nodeFactory->newInstance(id, shared_from_this());
+    node->setHandle(handle);
     addNodeCallback(node);
 
     listeners.sendNodeAdded(id);
@@ -99,6 +105,11 @@ std::shared_ptr<Edge> AbstractGraph::addEdge(const std::string& id, std::shared_
                    std::dynamic_pointer_cast<AbstractNode>(to), to->getId(), directed);
 }
 
+std::shared_ptr<Edge> AbstractGraph::addEdge(ElementHandle handle, ElementHandle from, ElementHandle to, bool directed) {
+    return addEdge(handle, std::dynamic_pointer_cast<AbstractNode>(getNode(from)), from,
+                   std::dynamic_pointer_cast<AbstractNode>(getNode(to)), to, directed);
+}
+
 std::shared_ptr<Node> AbstractGraph::removeNode(std::shared_ptr<Node> node) {
     if (node == nullptr) return nullptr;
 
@@ -128,6 +139,29 @@ std::shared_ptr<Edge> AbstractGraph::removeEdge(std::shared_ptr<Node> node1, std
     return removeEdge(edge);
 }
 
+// Handles
+ElementHandle AbstractGraph::intern(const std::string& id) {
+    return ids.intern(id);
+}
+
+ElementHandle AbstractGraph::findHandle(const std::string& id) const {
+    return ids.find(id);
+}
+
+const std::string& AbstractGraph::idOf(ElementHandle handle) const {
+    return ids.idOf(handle);
+}
+
+std::shared_ptr<Edge> AbstractGraph::getEdgeBetween(ElementHandle node1, ElementHandle node2) const {
+    auto n1 = getNode(node1);
+    auto n2 = getNode(node2);
+
+    if (n1 == nullptr || n2 == nullptr) {
+        return nullptr;
+    }
+    return n1->getEdgeBetween(n2);
+}
+
 // Sinks and sources
 std::vector<std::shared_ptr<AttributeSink>> AbstractGraph::attributeSinks() {
     return listeners.attributeSinks();
@@ -182,7 +216,17 @@ std::unique_ptr<Replayable::Controller> AbstractGraph::getReplayController() {
 std::shared_ptr<Edge> AbstractGraph::addEdge(const std::string& edgeId, std::shared_ptr<AbstractNode> src, 
                                              const std::string& srcId, std::shared_ptr<AbstractNode> dst, 
                                              const std::string& dstId, bool directed) {
-    auto edge = std::dynamic_pointer_cast<AbstractEdge>(getEdge(edgeId));
+    return addEdge(ids.intern(edgeId), src, ids.intern(srcId), dst, ids.intern(dstId), directed);
+}
+
+std::shared_ptr<Edge> AbstractGraph::addEdge(ElementHandle edgeHandle, std::shared_ptr<AbstractNode> src,
+                                             ElementHandle srcHandle, std::shared_ptr<AbstractNode> dst,
+                                             ElementHandle dstHandle, bool directed) {
+    const std::string& edgeId = ids.idOf(edgeHandle);
+    const std::string& srcId = ids.idOf(srcHandle);
+    const std::string& dstId = ids.idOf(dstHandle);
+
+    auto edge = std::dynamic_pointer_cast<AbstractEdge>(getEdge(edgeHandle));
 
     if (edge != nullptr) {
         if (strictChecking) {
@@ -204,8 +248,8 @@ std::shared_ptr<Edge> AbstractGraph::addEdge(const std::string& edgeId, std::sha
         }
         if (!autoCreate) return nullptr;
 
-        if (src == nullptr) src = std::dynamic_pointer_cast<AbstractNode>(addNode(srcId));
-        if (dst == nullptr) dst = std::dynamic_pointer_cast<AbstractNode>(addNode(dstId));
+        if (src == nullptr) src = std::dynamic_pointer_cast<AbstractNode>(addNode(srcHandle));
+        if (dst == nullptr) dst = std::dynamic_pointer_cast<AbstractNode>(addNode(dstHandle));
     }
 
     if (src->getGraph() != shared_from_this() || dst->getGraph() != shared_from_this()) {
@@ -213,6 +257,7 @@ std::shared_ptr<Edge> AbstractGraph::addEdge(const std::string& edgeId, std::sha
     }
 
     edge = edgeFactory->newInstance(edgeId, src, dst, directed);
+    edge->setHandle(edgeHandle);
 
     if (!src->addEdgeCallback(edge)) {
         if (strictChecking) {
@@ -294,7 +339,7 @@ void AbstractGraph::GraphReplayController::replay(const std::string& sourceId) {
 
     for (int i = 0; i < graph->getNodeCount(); ++i) {
         auto node = graph->getNode(i);
-        auto nodeId = node->getId();
+        const auto& nodeId = node->getId();
         sendNodeAdded(sourceId, nodeId);
 
         for (const auto& key : node->attributeKeys()) {
@@ -304,7 +349,7 @@ void AbstractGraph::GraphReplayController::replay(const std::string& sourceId) {
 
     for (int i = 0; i < graph->getEdgeCount(); ++i) {
         auto edge = graph->getEdge(i);
-        auto edgeId = edge->getId();
+        const auto& edgeId = edge->getId();
         sendEdgeAdded(sourceId, edgeId, edge->getNode0()->getId(), edge->getNode1()->getId(), edge->isDirected());
 
         for (const auto& key : edge->attributeKeys()) {
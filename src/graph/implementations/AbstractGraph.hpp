@@ -2,11 +2,13 @@
 #define ABSTRACT_GRAPH_HPP
 
 #include "AbstractElement.hpp"
+#include "AttributeColumns.hpp"
 #include "graph/Node.hpp"
 #include "graph/Edge.hpp"
 #include "graph/NodeFactory.hpp"
 #include "graph/EdgeFactory.hpp"
 #include "util/GraphListeners.hpp"
+#include "util/IdInterner.hpp"
 #include "stream/Replayable.hpp"
 #include "stream/SourceBase.hpp"
 #include <memory>
@@ -26,6 +28,13 @@ protected:
     double step;
     long replayId;
 
+    // Typed attribute storage of the nodes and edges, indexed by element index
+    AttributeColumns nodeColumns;
+    AttributeColumns edgeColumns;
+
+    // Graph-wide identifier interner shared by nodes and edges
+    IdInterner ids;
+
 public:
     // Constructors
     AbstractGraph(const std::string& id);
@@ -56,6 +65,18 @@ public:
     virtual std::shared_ptr<Edge> removeEdge(std::shared_ptr<Edge> edge) override;
     virtual std::shared_ptr<Edge> removeEdge(std::shared_ptr<Node> node1, std::shared_ptr<Node> node2) override;
 
+    // Handle based access. Handles are obtained once through intern() and
+    // avoid hashing and copying identifiers on every call.
+    ElementHandle intern(const std::string& id);
+    ElementHandle findHandle(const std::string& id) const;
+    const std::string& idOf(ElementHandle handle) const;
+
+    virtual std::shared_ptr<Node> addNode(ElementHandle handle);
+    virtual std::shared_ptr<Edge> addEdge(ElementHandle handle, ElementHandle from, ElementHandle to, bool directed);
+    virtual std::shared_ptr<Node> getNode(ElementHandle handle) const = 0;
+    virtual std::shared_ptr<Edge> getEdge(ElementHandle handle) const = 0;
+    std::shared_ptr<Edge> getEdgeBetween(ElementHandle node1, ElementHandle node2) const;
+
     // Sinks and sources
     virtual std::vector<std::shared_ptr<AttributeSink>> attributeSinks() override;
     virtual std::vector<std::shared_ptr<ElementSink>> elementSinks() override;
@@ -83,6 +104,9 @@ protected:
     std::shared_ptr<Edge> addEdge(const std::string& edgeId, std::shared_ptr<AbstractNode> src, 
                                   const std::string& srcId, std::shared_ptr<AbstractNode> dst, 
                                   const std::string& dstId, bool directed);
+    std::shared_ptr<Edge> addEdge(ElementHandle edgeHandle, std::shared_ptr<AbstractNode> src,
+                                  ElementHandle srcHandle, std::shared_ptr<AbstractNode> dst,
+                                  ElementHandle dstHandle, bool directed);
 
     void removeNode(std::shared_ptr<AbstractNode> node, bool graphCallback);
     void removeEdge(std::shared_ptr<AbstractEdge> edge, bool graphCallback, 
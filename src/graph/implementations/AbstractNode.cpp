@@ -12,6 +12,10 @@ void AbstractNode::attributeChanged(AttributeChangeEvent event, const std::strin
     graph->listeners.sendAttributeChangedEvent(id, SourceBase::ElementType::NODE, attribute, event, oldValue, newValue);
 }
 
+bool AbstractNode::hasAttributeListeners() const {
+    return !graph->listeners.attributeSinks().empty();
+}
+
 // Get the graph to which this node belongs
 std::shared_ptr<Graph> AbstractNode::getGraph() const {
     return graph;
@@ -47,6 +47,9 @@ public:
     bool isEnteringEdge(std::shared_ptr<Edge> e) const;
     bool isLeavingEdge(std::shared_ptr<Edge> e) const;
     bool isIncidentEdge(std::shared_ptr<Edge> e) const;
+
+protected:
+    bool hasAttributeListeners() const override;
 };
 
 #endif // ABSTRACT_NODE_HPP
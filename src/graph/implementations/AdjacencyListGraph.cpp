@@ -18,8 +18,9 @@ AdjacencyListGraph::AdjacencyListGraph(const std::string& id, bool strictCheckin
         initialEdgeCapacity = DEFAULT_EDGE_CAPACITY;
     }
 
-    nodeMap.reserve(4 * initialNodeCapacity / 3 + 1);
-    edgeMap.reserve(4 * initialEdgeCapacity / 3 + 1);
+    ids.reserve(initialNodeCapacity + initialEdgeCapacity);
+    nodeIndexByHandle.reserve(initialNodeCapacity + initialEdgeCapacity);
+    edgeIndexByHandle.reserve(initialNodeCapacity + initialEdgeCapacity);
     nodeArray.reserve(initialNodeCapacity);
     edgeArray.reserve(initialEdgeCapacity);
 
@@ -42,44 +43,69 @@ AdjacencyListGraph::AdjacencyListGraph(const std::string& id)
 
 // Callbacks
 void AdjacencyListGraph::addEdgeCallback(std::shared_ptr<AbstractEdge> edge) {
-    edgeMap[edge->getId()] = edge;
+    invalidateSnapshot();
+    bindHandle(edgeIndexByHandle, edge->getHandle(), edgeCount);
 
     if (edgeCount == edgeArray.size()) {
         edgeArray.resize(static_cast<int>(edgeArray.size() * GROW_FACTOR) + 1);
     }
     edgeArray[edgeCount] = edge;
     edge->setIndex(edgeCount++);
+    edge->attachColumns(&edgeColumns);
 }
 
 void AdjacencyListGraph::addNodeCallback(std::shared_ptr<AbstractNode> node) {
-    nodeMap[node->getId()] = node;
+    invalidateSnapshot();
+    bindHandle(nodeIndexByHandle, node->getHandle(), nodeCount);
 
     if (nodeCount == nodeArray.size()) {
         nodeArray.resize(static_cast<int>(nodeArray.size() * GROW_FACTOR) + 1);
     }
     nodeArray[nodeCount] = node;
     node->setIndex(nodeCount++);
+    node->attachColumns(&nodeColumns);
 }
 
 void AdjacencyListGraph::removeEdgeCallback(std::shared_ptr<AbstractEdge> edge) {
-    edgeMap.erase(edge->getId());
+    invalidateSnapshot();
+    bindHandle(edgeIndexByHandle, edge->getHandle(), -1);
+    edge->detachColumns(true);
     int i = edge->getIndex();
     edgeArray[i] = edgeArray[--edgeCount];
+    edgeColumns.moveSlot(edgeCount, i);
     edgeArray[i]->setIndex(i);
+    if (i < edgeCount) {
+        bindHandle(edgeIndexByHandle, edgeArray[i]->getHandle(), i);
+    }
     edgeArray[edgeCount] = nullptr;
 }
 
 void AdjacencyListGraph::removeNodeCallback(std::shared_ptr<AbstractNode> node) {
-    nodeMap.erase(node->getId());
+    invalidateSnapshot();
+    bindHandle(nodeIndexByHandle, node->getHandle(), -1);
+    node->detachColumns(true);
     int i = node->getIndex();
     nodeArray[i] = nodeArray[--nodeCount];
+    nodeColumns.moveSlot(nodeCount, i);
     nodeArray[i]->setIndex(i);
+    if (i < nodeCount) {
+        bindHandle(nodeIndexByHandle, nodeArray[i]->getHandle(), i);
+    }
     nodeArray[nodeCount] = nullptr;
 }
 
 void AdjacencyListGraph::clearCallback() {
-    nodeMap.clear();
-    edgeMap.clear();
+    invalidateSnapshot();
+    for (int i = 0; i < nodeCount; i++) {
+        nodeArray[i]->detachColumns(false);
+    }
+    for (int i = 0; i < edgeCount; i++) {
+        edgeArray[i]->detachColumns(false);
+    }
+    nodeColumns.clear();
+    edgeColumns.clear();
+    nodeIndexByHandle.clear();
+    edgeIndexByHandle.clear();
     nodeArray.clear();
     edgeArray.clear();
     nodeCount = edgeCount = 0;
@@ -95,8 +121,12 @@ std::vector<std::shared_ptr<Edge>> AdjacencyListGraph::edges() const {
 }
 
 std::shared_ptr<Edge> AdjacencyListGraph::getEdge(const std::string& id) const {
-    auto it = edgeMap.find(id);
-    return (it != edgeMap.end()) ? it->second : nullptr;
+    return getEdge(ids.find(id));
+}
+
+std::shared_ptr<Edge> AdjacencyListGraph::getEdge(ElementHandle handle) const {
+    int i = lookupHandle(edgeIndexByHandle, handle);
+    return i >= 0 ? edgeArray[i] : nullptr;
 }
 
 std::shared_ptr<Edge> AdjacencyListGraph::getEdge(int index) const {
@@ -111,8 +141,12 @@ int AdjacencyListGraph::getEdgeCount() const {
 }
 
 std::shared_ptr<Node> AdjacencyListGraph::getNode(const std::string& id) const {
-    auto it = nodeMap.find(id);
-    return (it != nodeMap.end()) ? it->second : nullptr;
+    return getNode(ids.find(id));
+}
+
+std::shared_ptr<Node> AdjacencyListGraph::getNode(ElementHandle handle) const {
+    int i = lookupHandle(nodeIndexByHandle, handle);
+    return i >= 0 ? nodeArray[i] : nullptr;
 }
 
 std::shared_ptr<Node> AdjacencyListGraph::getNode(int index) const {
@@ -126,6 +160,39 @@ int AdjacencyListGraph::getNodeCount() const {
     return nodeCount;
 }
 
+// Handles
+void AdjacencyListGraph::bindHandle(std::vector<int>& table, ElementHandle handle, int index) {
+    if (handle == IdInterner::INVALID) return;
+
+    uint32_t h = IdInterner::indexOf(handle);
+
+    if (h >= table.size()) {
+        if (index < 0) return;
+        table.resize(h + 1, -1);
+    }
+    table[h] = index;
+}
+
+int AdjacencyListGraph::lookupHandle(const std::vector<int>& table, ElementHandle handle) {
+    uint32_t h = IdInterner::indexOf(handle);
+    return h < table.size() ? table[h] : -1;
+}
+
+// Snapshot
+std::shared_ptr<const AdjacencyListSnapshot> AdjacencyListGraph::snapshot() const {
+    if (!frozen) {
+        frozen = std::make_shared<AdjacencyListSnapshot>(*this);
+    }
+    return frozen;
+}
+
+void AdjacencyListGraph::invalidateSnapshot() {
+    if (frozen) {
+        frozen->invalidate();
+        frozen.reset();
+    }
+}
+
 // Iterators
 template<typename T>
 AdjacencyListGraph::EdgeIterator<T>::EdgeIterator(AdjacencyListGraph& graph)
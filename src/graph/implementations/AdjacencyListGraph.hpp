@@ -3,6 +3,7 @@
 
 #include "AbstractGraph.hpp"
 #include "AdjacencyListNode.hpp"
+#include "AdjacencyListSnapshot.hpp"
 #include <vector>
 #include <unordered_map>
 #include <memory>
@@ -45,6 +46,14 @@ public:
     std::shared_ptr<Node> getNode(int index) const override;
     int getNodeCount() const override;
 
+    std::shared_ptr<Node> getNode(ElementHandle handle) const override;
+    std::shared_ptr<Edge> getEdge(ElementHandle handle) const override;
+
+    // Snapshot
+    // Compact read-only view of the current structure, built on first use and
+    // shared until the next structural change invalidates it.
+    std::shared_ptr<const AdjacencyListSnapshot> snapshot() const;
+
     // Iterators
 protected:
     template<typename T>
@@ -78,14 +87,24 @@ protected:
     };
 
 private:
-    std::unordered_map<std::string, std::shared_ptr<AbstractNode>> nodeMap;
-    std::unordered_map<std::string, std::shared_ptr<AbstractEdge>> edgeMap;
+    friend class AdjacencyListSnapshot;
+
+    void invalidateSnapshot();
+
+    static void bindHandle(std::vector<int>& table, ElementHandle handle, int index);
+    static int lookupHandle(const std::vector<int>& table, ElementHandle handle);
+
+    // Position in nodeArray/edgeArray of each interned handle, -1 if none
+    std::vector<int> nodeIndexByHandle;
+    std::vector<int> edgeIndexByHandle;
 
     std::vector<std::shared_ptr<AbstractNode>> nodeArray;
     std::vector<std::shared_ptr<AbstractEdge>> edgeArray;
 
     int nodeCount;
     int edgeCount;
+
+    mutable std::shared_ptr<AdjacencyListSnapshot> frozen;
 };
 
 #endif // ADJACENCY_LIST_GRAPH_HPP
@@ -11,6 +11,8 @@
 #include <algorithm>
 
 class AdjacencyListNode : public AbstractNode {
+    friend class AdjacencyListSnapshot;
+
 protected:
     static constexpr int INITIAL_EDGE_CAPACITY = 16;
     static constexpr double GROWTH_FACTOR = 1.1;
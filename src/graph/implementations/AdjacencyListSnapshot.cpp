@@ -0,0 +1,204 @@
+#include "AdjacencyListSnapshot.hpp"
+#include "AdjacencyListGraph.hpp"
+#include "AdjacencyListNode.hpp"
+#include "AbstractEdge.hpp"
+#include <stdexcept>
+#include <string>
+
+// Constructor
+AdjacencyListSnapshot::AdjacencyListSnapshot(const AdjacencyListGraph& graph)
+    : valid(true), nodeCount(graph.nodeCount), edgeCount(graph.edgeCount) {
+
+    edgeSource.resize(edgeCount);
+    edgeTarget.resize(edgeCount);
+    edgeDirected.resize(edgeCount);
+
+    for (int e = 0; e < edgeCount; e++) {
+        const auto& edge = graph.edgeArray[e];
+        edgeSource[e] = edge->getSourceNode()->getIndex();
+        edgeTarget[e] = edge->getTargetNode()->getIndex();
+        edgeDirected[e] = edge->isDirected() ? 1 : 0;
+    }
+
+    nodeStart.resize(nodeCount + 1);
+    nodeIoStart.resize(nodeCount);
+    nodeOStart.resize(nodeCount);
+
+    int32_t slots = 0;
+    for (int i = 0; i < nodeCount; i++) {
+        nodeStart[i] = slots;
+        slots += std::static_pointer_cast<AdjacencyListNode>(graph.nodeArray[i])->degree;
+    }
+    nodeStart[nodeCount] = slots;
+
+    neighborArray.resize(slots);
+    edgeIndexArray.resize(slots);
+
+    for (int i = 0; i < nodeCount; i++) {
+        auto node = std::static_pointer_cast<AdjacencyListNode>(graph.nodeArray[i]);
+        int32_t base = nodeStart[i];
+
+        nodeIoStart[i] = base + node->ioStart;
+        nodeOStart[i] = base + node->oStart;
+
+        for (int k = 0; k < node->degree; k++) {
+            int32_t e = node->edges[k]->getIndex();
+            edgeIndexArray[base + k] = e;
+            neighborArray[base + k] = edgeSource[e] == i ? edgeTarget[e] : edgeSource[e];
+        }
+    }
+}
+
+// Validity
+bool AdjacencyListSnapshot::isValid() const {
+    return valid.load(std::memory_order_acquire);
+}
+
+void AdjacencyListSnapshot::invalidate() {
+    valid.store(false, std::memory_order_release);
+}
+
+// Counts
+int AdjacencyListSnapshot::getNodeCount() const {
+    return nodeCount;
+}
+
+int AdjacencyListSnapshot::getEdgeCount() const {
+    return edgeCount;
+}
+
+int AdjacencyListSnapshot::getDegree(int node) const {
+    checkNode(node);
+    return nodeStart[node + 1] - nodeStart[node];
+}
+
+int AdjacencyListSnapshot::getInDegree(int node) const {
+    checkNode(node);
+    return nodeOStart[node] - nodeStart[node];
+}
+
+int AdjacencyListSnapshot::getOutDegree(int node) const {
+    checkNode(node);
+    return nodeStart[node + 1] - nodeIoStart[node];
+}
+
+// Neighbor ranges
+std::span<const int32_t> AdjacencyListSnapshot::neighbors(int node) const {
+    checkNode(node);
+    return std::span<const int32_t>(neighborArray.data() + nodeStart[node], neighborArray.data() + nodeStart[node + 1]);
+}
+
+std::span<const int32_t> AdjacencyListSnapshot::enteringNeighbors(int node) const {
+    checkNode(node);
+    return std::span<const int32_t>(neighborArray.data() + nodeStart[node], neighborArray.data() + nodeOStart[node]);
+}
+
+std::span<const int32_t> AdjacencyListSnapshot::leavingNeighbors(int node) const {
+    checkNode(node);
+    return std::span<const int32_t>(neighborArray.data() + nodeIoStart[node], neighborArray.data() + nodeStart[node + 1]);
+}
+
+// Edge ranges
+std::span<const int32_t> AdjacencyListSnapshot::edges(int node) const {
+    checkNode(node);
+    return std::span<const int32_t>(edgeIndexArray.data() + nodeStart[node], edgeIndexArray.data() + nodeStart[node + 1]);
+}
+
+std::span<const int32_t> AdjacencyListSnapshot::enteringEdges(int node) const {
+    checkNode(node);
+    return std::span<const int32_t>(edgeIndexArray.data() + nodeStart[node], edgeIndexArray.data() + nodeOStart[node]);
+}
+
+std::span<const int32_t> AdjacencyListSnapshot::leavingEdges(int node) const {
+    checkNode(node);
+    return std::span<const int32_t>(edgeIndexArray.data() + nodeIoStart[node], edgeIndexArray.data() + nodeStart[node + 1]);
+}
+
+// Edge endpoints
+int AdjacencyListSnapshot::getSourceNode(int edge) const {
+    return edgeSource.at(edge);
+}
+
+int AdjacencyListSnapshot::getTargetNode(int edge) const {
+    return edgeTarget.at(edge);
+}
+
+bool AdjacencyListSnapshot::isDirected(int edge) const {
+    return edgeDirected.at(edge) != 0;
+}
+
+// Traversals
+std::vector<int32_t> AdjacencyListSnapshot::breadthFirst(int start, bool directed, std::vector<int>* depth) const {
+    checkNode(start);
+
+    std::vector<int> localDepth;
+    std::vector<int>& d = depth ? *depth : localDepth;
+    d.assign(nodeCount, -1);
+
+    std::vector<int32_t> queue;
+    queue.reserve(nodeCount);
+    queue.push_back(start);
+    d[start] = 0;
+
+    for (size_t qHead = 0; qHead < queue.size(); qHead++) {
+        int32_t current = queue[qHead];
+        int level = d[current] + 1;
+        int32_t from = directed ? nodeIoStart[current] : nodeStart[current];
+        int32_t to = nodeStart[current + 1];
+
+        for (int32_t k = from; k < to; k++) {
+            int32_t j = neighborArray[k];
+
+            if (d[j] == -1) {
+                d[j] = level;
+                queue.push_back(j);
+            }
+        }
+    }
+
+    return queue;
+}
+
+std::vector<int32_t> AdjacencyListSnapshot::depthFirst(int start, bool directed, std::vector<int>* depth) const {
+    checkNode(start);
+
+    std::vector<int> localDepth;
+    std::vector<int>& d = depth ? *depth : localDepth;
+    d.assign(nodeCount, -1);
+
+    std::vector<int32_t> order;
+    std::vector<int32_t> stack;
+    std::vector<int32_t> cursor(nodeCount);
+
+    order.push_back(start);
+    stack.push_back(start);
+    d[start] = 0;
+    cursor[start] = directed ? nodeIoStart[start] : nodeStart[start];
+
+    while (!stack.empty()) {
+        int32_t current = stack.back();
+        int32_t& k = cursor[current];
+
+        while (k < nodeStart[current + 1] && d[neighborArray[k]] != -1)
+            k++;
+
+        if (k == nodeStart[current + 1]) {
+            stack.pop_back();
+            continue;
+        }
+
+        int32_t j = neighborArray[k++];
+        d[j] = d[current] + 1;
+        cursor[j] = directed ? nodeIoStart[j] : nodeStart[j];
+        order.push_back(j);
+        stack.push_back(j);
+    }
+
+    return order;
+}
+
+// Helpers
+void AdjacencyListSnapshot::checkNode(int node) const {
+    if (node < 0 || node >= nodeCount)
+        throw std::out_of_range("Node " + std::to_string(node) + " does not exist in snapshot");
+}
@@ -0,0 +1,83 @@
+#ifndef ADJACENCY_LIST_SNAPSHOT_HPP
+#define ADJACENCY_LIST_SNAPSHOT_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class AdjacencyListGraph;
+
+/**
+ * Immutable compressed-sparse-row view of an AdjacencyListGraph.
+ *
+ * Nodes and edges are identified by their index in the graph at the time the
+ * snapshot was built. The adjacency of node i lives in
+ * [nodeStart[i], nodeStart[i + 1]) and keeps the partitioning of
+ * AdjacencyListNode: entering edges first, then undirected edges and loops
+ * (from ioStart), then leaving edges (from oStart). Each slot stores the
+ * index of the opposite node and, in a parallel array, the index of the edge.
+ *
+ * A snapshot is invalidated as soon as the structure of its graph changes.
+ */
+class AdjacencyListSnapshot {
+public:
+    explicit AdjacencyListSnapshot(const AdjacencyListGraph& graph);
+
+    AdjacencyListSnapshot(const AdjacencyListSnapshot&) = delete;
+    AdjacencyListSnapshot& operator=(const AdjacencyListSnapshot&) = delete;
+
+    // Validity
+    bool isValid() const;
+    void invalidate();
+
+    // Counts
+    int getNodeCount() const;
+    int getEdgeCount() const;
+
+    int getDegree(int node) const;
+    int getInDegree(int node) const;
+    int getOutDegree(int node) const;
+
+    // Neighbor ranges (opposite node indices)
+    std::span<const int32_t> neighbors(int node) const;
+    std::span<const int32_t> enteringNeighbors(int node) const;
+    std::span<const int32_t> leavingNeighbors(int node) const;
+
+    // Edge ranges, parallel to the neighbor ranges (edge indices)
+    std::span<const int32_t> edges(int node) const;
+    std::span<const int32_t> enteringEdges(int node) const;
+    std::span<const int32_t> leavingEdges(int node) const;
+
+    // Edge endpoints
+    int getSourceNode(int edge) const;
+    int getTargetNode(int edge) const;
+    bool isDirected(int edge) const;
+
+    // Traversals. Nodes are returned in visit order; when given, depth is
+    // resized to the node count and filled with the depth of each reached
+    // node, -1 for the others.
+    std::vector<int32_t> breadthFirst(int start, bool directed = true, std::vector<int>* depth = nullptr) const;
+    std::vector<int32_t> depthFirst(int start, bool directed = true, std::vector<int>* depth = nullptr) const;
+
+private:
+    void checkNode(int node) const;
+
+    std::atomic<bool> valid;
+
+    int nodeCount;
+    int edgeCount;
+
+    std::vector<int32_t> nodeStart;
+    std::vector<int32_t> nodeIoStart;
+    std::vector<int32_t> nodeOStart;
+
+    std::vector<int32_t> neighborArray;
+    std::vector<int32_t> edgeIndexArray;
+
+    std::vector<int32_t> edgeSource;
+    std::vector<int32_t> edgeTarget;
+    std::vector<uint8_t> edgeDirected;
+};
+
+#endif // ADJACENCY_LIST_SNAPSHOT_HPP
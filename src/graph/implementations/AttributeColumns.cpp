@@ -0,0 +1,212 @@
+#include "AttributeColumns.hpp"
+#include <stdexcept>
+
+// Keys
+int AttributeColumns::intern(const std::string& key) {
+    auto it = keyIds.find(key);
+    if (it != keyIds.end()) {
+        return it->second;
+    }
+
+    int keyId = static_cast<int>(keys.size());
+    keyIds.emplace(key, keyId);
+    keys.push_back(key);
+    columns.emplace_back();
+    return keyId;
+}
+
+int AttributeColumns::find(const std::string& key) const {
+    auto it = keyIds.find(key);
+    return it != keyIds.end() ? it->second : -1;
+}
+
+const std::string& AttributeColumns::keyOf(int keyId) const {
+    return keys.at(keyId);
+}
+
+int AttributeColumns::getKeyCount() const {
+    return static_cast<int>(keys.size());
+}
+
+// Access
+AttributeColumns::Kind AttributeColumns::kindOf(int keyId, int slot) const {
+    if (keyId < 0 || slot < 0) {
+        return Kind::NONE;
+    }
+
+    const Column& column = columns[keyId];
+    return slot < static_cast<int>(column.kinds.size()) ? column.kinds[slot] : Kind::NONE;
+}
+
+bool AttributeColumns::has(int keyId, int slot) const {
+    return kindOf(keyId, slot) != Kind::NONE;
+}
+
+double AttributeColumns::getDouble(int keyId, int slot) const {
+    if (kindOf(keyId, slot) != Kind::DOUBLE) {
+        throw std::logic_error("Attribute \"" + keyOf(keyId) + "\" is not a double");
+    }
+    return columns[keyId].doubles[slot];
+}
+
+int64_t AttributeColumns::getInt64(int keyId, int slot) const {
+    if (kindOf(keyId, slot) != Kind::INT64) {
+        throw std::logic_error("Attribute \"" + keyOf(keyId) + "\" is not an integer");
+    }
+    return columns[keyId].ints[slot];
+}
+
+const std::string& AttributeColumns::getString(int keyId, int slot) const {
+    if (kindOf(keyId, slot) != Kind::STRING) {
+        throw std::logic_error("Attribute \"" + keyOf(keyId) + "\" is not a string");
+    }
+    return columns[keyId].strings[slot];
+}
+
+std::shared_ptr<void> AttributeColumns::box(int keyId, int slot) const {
+    switch (kindOf(keyId, slot)) {
+    case Kind::DOUBLE:
+        return std::make_shared<double>(columns[keyId].doubles[slot]);
+    case Kind::INT64:
+        return std::make_shared<int64_t>(columns[keyId].ints[slot]);
+    case Kind::STRING:
+        return std::make_shared<std::string>(columns[keyId].strings[slot]);
+    default:
+        return nullptr;
+    }
+}
+
+// Commands
+AttributeColumns::Column& AttributeColumns::prepare(int keyId, int slot, Kind kind) {
+    Column& column = columns.at(keyId);
+
+    if (slot >= static_cast<int>(column.kinds.size())) {
+        column.kinds.resize(slot + 1, Kind::NONE);
+    }
+
+    switch (kind) {
+    case Kind::DOUBLE:
+        if (slot >= static_cast<int>(column.doubles.size()))
+            column.doubles.resize(column.kinds.size());
+        break;
+    case Kind::INT64:
+        if (slot >= static_cast<int>(column.ints.size()))
+            column.ints.resize(column.kinds.size());
+        break;
+    case Kind::STRING:
+        if (slot >= static_cast<int>(column.strings.size()))
+            column.strings.resize(column.kinds.size());
+        break;
+    default:
+        break;
+    }
+
+    return column;
+}
+
+AttributeColumns::Kind AttributeColumns::setDouble(int keyId, int slot, double value) {
+    Column& column = prepare(keyId, slot, Kind::DOUBLE);
+    Kind old = column.kinds[slot];
+
+    if (old == Kind::STRING)
+        column.strings[slot].clear();
+
+    column.doubles[slot] = value;
+    column.kinds[slot] = Kind::DOUBLE;
+    return old;
+}
+
+AttributeColumns::Kind AttributeColumns::setInt64(int keyId, int slot, int64_t value) {
+    Column& column = prepare(keyId, slot, Kind::INT64);
+    Kind old = column.kinds[slot];
+
+    if (old == Kind::STRING)
+        column.strings[slot].clear();
+
+    column.ints[slot] = value;
+    column.kinds[slot] = Kind::INT64;
+    return old;
+}
+
+AttributeColumns::Kind AttributeColumns::setString(int keyId, int slot, const std::string& value) {
+    Column& column = prepare(keyId, slot, Kind::STRING);
+    Kind old = column.kinds[slot];
+
+    column.strings[slot] = value;
+    column.kinds[slot] = Kind::STRING;
+    return old;
+}
+
+void AttributeColumns::remove(int keyId, int slot) {
+    Kind kind = kindOf(keyId, slot);
+
+    if (kind == Kind::NONE)
+        return;
+
+    Column& column = columns[keyId];
+
+    if (kind == Kind::STRING)
+        column.strings[slot].clear();
+
+    column.kinds[slot] = Kind::NONE;
+}
+
+// Slot management
+int AttributeColumns::countOf(int slot) const {
+    int count = 0;
+
+    for (int k = 0; k < static_cast<int>(columns.size()); k++) {
+        if (has(k, slot))
+            count++;
+    }
+
+    return count;
+}
+
+void AttributeColumns::keysOf(int slot, std::vector<std::string>& out) const {
+    for (int k = 0; k < static_cast<int>(columns.size()); k++) {
+        if (has(k, slot))
+            out.push_back(keys[k]);
+    }
+}
+
+void AttributeColumns::clearSlot(int slot) {
+    for (int k = 0; k < static_cast<int>(columns.size()); k++) {
+        remove(k, slot);
+    }
+}
+
+void AttributeColumns::moveSlot(int from, int to) {
+    if (from == to)
+        return;
+
+    for (int k = 0; k < static_cast<int>(columns.size()); k++) {
+        switch (kindOf(k, from)) {
+        case Kind::DOUBLE:
+            setDouble(k, to, columns[k].doubles[from]);
+            break;
+        case Kind::INT64:
+            setInt64(k, to, columns[k].ints[from]);
+            break;
+        case Kind::STRING:
+            prepare(k, to, Kind::STRING);
+            columns[k].strings[to] = std::move(columns[k].strings[from]);
+            columns[k].kinds[to] = Kind::STRING;
+            break;
+        default:
+            remove(k, to);
+            continue;
+        }
+
+        remove(k, from);
+    }
+}
+
+void AttributeColumns::clear() {
+    for (auto& column : columns) {
+        column.kinds.clear();
+        column.doubles.clear();
+        column.ints.clear();
+        column.strings.clear();
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef ATTRIBUTE_COLUMNS_HPP
+#define ATTRIBUTE_COLUMNS_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Graph-level columnar storage for typed attributes.
+ *
+ * Attribute keys are interned into small integer ids. For each key, values
+ * are kept in dense double, int64 or string columns indexed by the element
+ * index (a "slot"). A slot holds at most one value per key; its kind tells
+ * which column is live. Values of any other type stay in the per-element
+ * attribute map of AbstractElement.
+ */
+class AttributeColumns {
+public:
+    enum class Kind : uint8_t {
+        NONE,
+        DOUBLE,
+        INT64,
+        STRING
+    };
+
+    AttributeColumns() = default;
+
+    // Keys
+    int intern(const std::string& key);
+    int find(const std::string& key) const;
+    const std::string& keyOf(int keyId) const;
+    int getKeyCount() const;
+
+    // Access
+    Kind kindOf(int keyId, int slot) const;
+    bool has(int keyId, int slot) const;
+    double getDouble(int keyId, int slot) const;
+    int64_t getInt64(int keyId, int slot) const;
+    const std::string& getString(int keyId, int slot) const;
+
+    // Boxes the value in the representation used by the attribute map, or
+    // returns nullptr if the slot has no value for this key.
+    std::shared_ptr<void> box(int keyId, int slot) const;
+
+    // Commands. Setters return the kind previously stored in the slot.
+    Kind setDouble(int keyId, int slot, double value);
+    Kind setInt64(int keyId, int slot, int64_t value);
+    Kind setString(int keyId, int slot, const std::string& value);
+    void remove(int keyId, int slot);
+
+    // Slot management
+    int countOf(int slot) const;
+    void keysOf(int slot, std::vector<std::string>& keys) const;
+    void clearSlot(int slot);
+    void moveSlot(int from, int to);
+    void clear();
+
+private:
+    struct Column {
+        std::vector<Kind> kinds;
+        std::vector<double> doubles;
+        std::vector<int64_t> ints;
+        std::vector<std::string> strings;
+    };
+
+    Column& prepare(int keyId, int slot, Kind kind);
+
+    std::unordered_map<std::string, int> keyIds;
+    std::vector<std::string> keys;
+    std::vector<Column> columns;
+};
+
+#endif // ATTRIBUTE_COLUMNS_HPP
@@ -113,7 +113,7 @@ void Graphs::SynchronizedElement::clearAttributes() {
     wrappedElement->clearAttributes();
 }
 
-std::string Graphs::SynchronizedElement::getId() const {
+const std::string& Graphs::SynchronizedElement::getId() const {
     return wrappedElement->getId();
 }
 
@@ -42,7 +42,7 @@ public:
 
     void setAttribute(const std::string& attribute, const std::vector<std::string>& values);
     void clearAttributes();
-    std::string getId() const;
+    const std::string& getId() const;
     int getIndex() const;
 
 protected:
@@ -0,0 +1,102 @@
+#include "NeighborIndex.hpp"
+#include <stdexcept>
+#include <string>
+
+// Constructor
+NeighborIndex::NeighborIndex()
+    : table(size_t(1) << MIN_BITS, Entry{0, EMPTY}), mask((size_t(1) << MIN_BITS) - 1), bits(MIN_BITS), count(0) {}
+
+// Commands
+void NeighborIndex::insert(uint32_t key, int32_t slot) {
+    if (2 * (count + 1) > static_cast<int>(table.size()))
+        grow();
+
+    size_t i = home(key);
+    while (table[i].slot != EMPTY)
+        i = (i + 1) & mask;
+
+    table[i] = Entry{key, slot};
+    count++;
+}
+
+void NeighborIndex::erase(uint32_t key, int32_t slot) {
+    size_t i = locate(key, slot);
+
+    // Backward-shift deletion: pull up every following entry of the cluster
+    // whose home position does not lie in (i, j].
+    size_t j = i;
+    while (true) {
+        j = (j + 1) & mask;
+        if (table[j].slot == EMPTY)
+            break;
+
+        size_t k = home(table[j].key);
+        bool movable = i <= j ? (k <= i || k > j) : (k <= i && k > j);
+
+        if (movable) {
+            table[i] = table[j];
+            i = j;
+        }
+    }
+
+    table[i] = Entry{0, EMPTY};
+    count--;
+}
+
+void NeighborIndex::move(uint32_t key, int32_t from, int32_t to) {
+    table[locate(key, from)].slot = to;
+}
+
+void NeighborIndex::clear() {
+    table.assign(size_t(1) << MIN_BITS, Entry{0, EMPTY});
+    mask = table.size() - 1;
+    bits = MIN_BITS;
+    count = 0;
+}
+
+int NeighborIndex::size() const {
+    return count;
+}
+
+// Lookup
+int32_t NeighborIndex::firstSlot(uint32_t key, int32_t lo, int32_t hi) const {
+    int32_t best = -1;
+
+    if (count == 0) return best;
+
+    for (size_t i = home(key); table[i].slot != EMPTY; i = (i + 1) & mask) {
+        int32_t s = table[i].slot;
+
+        if (table[i].key == key && s >= lo && s < hi && (best == -1 || s < best))
+            best = s;
+    }
+    return best;
+}
+
+// Helpers
+size_t NeighborIndex::home(uint32_t key) const {
+    return static_cast<size_t>((uint64_t(key) * 0x9E3779B97F4A7C15ull) >> (64 - bits));
+}
+
+size_t NeighborIndex::locate(uint32_t key, int32_t slot) const {
+    for (size_t i = home(key); table[i].slot != EMPTY; i = (i + 1) & mask) {
+        if (table[i].key == key && table[i].slot == slot)
+            return i;
+    }
+    throw std::logic_error("Slot " + std::to_string(slot) + " is not indexed");
+}
+
+void NeighborIndex::grow() {
+    std::vector<Entry> old;
+    old.swap(table);
+
+    bits++;
+    table.assign(size_t(1) << bits, Entry{0, EMPTY});
+    mask = table.size() - 1;
+    count = 0;
+
+    for (const Entry& e : old) {
+        if (e.slot != EMPTY)
+            insert(e.key, e.slot);
+    }
+}
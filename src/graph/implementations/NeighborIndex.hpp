@@ -0,0 +1,62 @@
+#ifndef NEIGHBOR_INDEX_HPP
+#define NEIGHBOR_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Flat open-addressing multimap from the handle of an opposite node to the
+ * slots its edges occupy in the edge array of an AdjacencyListNode.
+ *
+ * Entries are stored inline and probed linearly; deletion shifts the
+ * following entries back so no tombstones are left behind. Several entries
+ * may share a key (parallel edges), but a slot appears at most once.
+ */
+class NeighborIndex {
+public:
+    NeighborIndex();
+
+    void insert(uint32_t key, int32_t slot);
+    void erase(uint32_t key, int32_t slot);
+    void move(uint32_t key, int32_t from, int32_t to);
+    void clear();
+
+    int size() const;
+
+    // Smallest slot bound to key within [lo, hi), or -1.
+    int32_t firstSlot(uint32_t key, int32_t lo, int32_t hi) const;
+
+    // Calls f(slot) for every slot bound to key until f returns true.
+    // Returns the slot f accepted, or -1.
+    template<typename F>
+    int32_t findSlot(uint32_t key, F&& f) const {
+        if (count == 0) return -1;
+
+        for (size_t i = home(key); table[i].slot != EMPTY; i = (i + 1) & mask) {
+            if (table[i].key == key && f(table[i].slot))
+                return table[i].slot;
+        }
+        return -1;
+    }
+
+private:
+    static constexpr int32_t EMPTY = -1;
+    static constexpr int MIN_BITS = 4;
+
+    struct Entry {
+        uint32_t key;
+        int32_t slot;
+    };
+
+    size_t home(uint32_t key) const;
+    size_t locate(uint32_t key, int32_t slot) const;
+    void grow();
+
+    std::vector<Entry> table;
+    size_t mask;
+    int bits;
+    int count;
+};
+
+#endif // NEIGHBOR_INDEX_HPP
@@ -142,7 +142,7 @@ void Sprite::setPosition(const Values& values) {
     }
 }
 
-std::string Sprite::getId() const {
+const std::string& Sprite::getId() const {
     return id;
 }
 
@@ -68,7 +68,7 @@ public:
     void setPosition(double x, double y, double z);
     void setPosition(Style::Units units, double x, double y, double z);
 
-    std::string getId() const override;
+    const std::string& getId() const override;
     std::string getLabel(const std::string& key) const override;
     std::any getAttribute(const std::string& key) const override;
     void setAttribute(const std::string& attribute, const std::vector<std::any>& values) override;
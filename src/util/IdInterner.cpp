@@ -0,0 +1,44 @@
+#include "IdInterner.hpp"
+#include <stdexcept>
+
+ElementHandle IdInterner::intern(std::string_view id) {
+    auto it = handles.find(id);
+    if (it != handles.end()) {
+        return it->second;
+    }
+
+    if (ids.size() >= UINT32_MAX) {
+        throw std::length_error("Too many identifiers to intern");
+    }
+
+    ElementHandle handle = static_cast<ElementHandle>(ids.size());
+    const std::string& stored = ids.emplace_back(id);
+    handles.emplace(std::string_view(stored), handle);
+    return handle;
+}
+
+ElementHandle IdInterner::find(std::string_view id) const {
+    auto it = handles.find(id);
+    return it != handles.end() ? it->second : INVALID;
+}
+
+const std::string& IdInterner::idOf(ElementHandle handle) const {
+    uint32_t i = indexOf(handle);
+
+    if (i >= ids.size()) {
+        throw std::out_of_range("Unknown handle " + std::to_string(i));
+    }
+    return ids[i];
+}
+
+int IdInterner::size() const {
+    return static_cast<int>(ids.size());
+}
+
+void IdInterner::reserve(int count) {
+    handles.reserve(count);
+}
+
+uint32_t IdInterner::indexOf(ElementHandle handle) {
+    return static_cast<uint32_t>(handle);
+}
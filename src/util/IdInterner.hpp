@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Stable 32-bit handle to an interned identifier. A distinct type so that
+// handle overloads never compete with the int index overloads of Graph.
+enum class ElementHandle : uint32_t {};
+
+// Maps identifiers to dense handles. Handles are never reused, and the
+// string bound to a handle keeps its address for the interner's lifetime.
+class IdInterner {
+public:
+    static constexpr ElementHandle INVALID = static_cast<ElementHandle>(UINT32_MAX);
+
+    IdInterner() = default;
+
+    IdInterner(const IdInterner&) = delete;
+    IdInterner& operator=(const IdInterner&) = delete;
+
+    // Returns the handle of id, creating it if needed.
+    ElementHandle intern(std::string_view id);
+
+    // Returns the handle of id, or INVALID if it was never interned.
+    ElementHandle find(std::string_view id) const;
+
+    const std::string& idOf(ElementHandle handle) const;
+
+    int size() const;
+    void reserve(int count);
+
+    static uint32_t indexOf(ElementHandle handle);
+
+private:
+    std::deque<std::string> ids;
+    std::unordered_map<std::string_view, ElementHandle> handles;
+};